@@ -331,6 +331,7 @@ Call structure DSM and FDJS
       Fsimp(:,:,:)  = 0.0
 
 !     *L0s  start loop over k,j,i
+!$omp parallel do private(i,j,ip,jq,kr,dumt,dums,drdh,drdz,slp,tpr)
       do k=1,l
          do j=1,m
 
@@ -499,6 +500,7 @@ Call structure DSM and FDJS
 
 !     *     Calculate divergence of the fluxes =========================================
 !     *L0s  start loop over k,j,i
+!$omp parallel do private(i,j,row)
       do k=1,l
          do j=1,m
             do i=1,n
@@ -795,6 +797,7 @@ Call structure DSM and FDJS
 ! note: row=i, columns are icol(ipntr(i):ipntr(i+1)-1)  
 
       numgrp = 0
+!$omp parallel do private(ix,iy,iz,ie,j,jx,jy,jz,je,s)
       do i=1,ndim               ! loop over rows, assumes col=.false. !!
          call findex(i,ix,iy,iz,ie)
          do j=vmix_ipntr(i),vmix_ipntr(i+1)-1 ! loop over columns (in approx.)